@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,11 +30,11 @@ namespace raylet {
 class MockWorker : public WorkerInterface {
  public:
   MockWorker(WorkerID worker_id, int port, int runtime_env_hash = 0)
-      : worker_id_(worker_id),
-        port_(port),
-        runtime_env_hash_(runtime_env_hash),
+      : proc_(Process::CreateNewDummy()),
+        worker_id_(worker_id),
         job_id_(JobID::FromInt(859)),
-        proc_(Process::CreateNewDummy()) {}
+        port_(port),
+        runtime_env_hash_(runtime_env_hash) {}
 
   WorkerID WorkerId() const override { return worker_id_; }
 
@@ -57,44 +59,71 @@ class MockWorker : public WorkerInterface {
 
   absl::Time GetAssignedTaskTime() const override { return task_assign_time_; };
 
-  std::optional<bool> GetIsGpu() const override { return is_gpu_; }
+  std::optional<bool> GetIsGpu() const override {
+    const uint8_t flags = flags_.load(std::memory_order_relaxed);
+    if ((flags & kIsGpuPresentFlag) == 0) {
+      return std::nullopt;
+    }
+    return (flags & kIsGpuValueFlag) != 0;
+  }
 
-  std::optional<bool> GetIsActorWorker() const override { return is_actor_worker_; }
+  std::optional<bool> GetIsActorWorker() const override {
+    const uint8_t flags = flags_.load(std::memory_order_relaxed);
+    if ((flags & kIsActorWorkerPresentFlag) == 0) {
+      return std::nullopt;
+    }
+    return (flags & kIsActorWorkerValueFlag) != 0;
+  }
 
   const std::string IpAddress() const override { return address_.ip_address(); }
 
   void AsyncNotifyGCSRestart() override {}
 
+  // The instance pointers are read and written through std::atomic_load/store
+  // so tests that touch the same mock worker from IO threads are well-defined
+  // without a mutex.
   void SetAllocatedInstances(
       const std::shared_ptr<TaskResourceInstances> &allocated_instances) override {
-    allocated_instances_ = allocated_instances;
+    std::atomic_store_explicit(
+        &allocated_instances_, allocated_instances, std::memory_order_release);
   }
 
   void SetLifetimeAllocatedInstances(
       const std::shared_ptr<TaskResourceInstances> &allocated_instances) override {
-    lifetime_allocated_instances_ = allocated_instances;
+    std::atomic_store_explicit(
+        &lifetime_allocated_instances_, allocated_instances, std::memory_order_release);
   }
 
   std::shared_ptr<TaskResourceInstances> GetAllocatedInstances() override {
-    return allocated_instances_;
+    return std::atomic_load_explicit(&allocated_instances_, std::memory_order_acquire);
   }
   std::shared_ptr<TaskResourceInstances> GetLifetimeAllocatedInstances() override {
-    return lifetime_allocated_instances_;
+    return std::atomic_load_explicit(&lifetime_allocated_instances_,
+                                     std::memory_order_acquire);
   }
 
   void MarkDead() override { RAY_CHECK(false) << "Method unused"; }
   bool IsDead() const override {
     RAY_CHECK(false) << "Method unused";
-    return killing_.load(std::memory_order_acquire);
+    return (flags_.load(std::memory_order_relaxed) & kKillingFlag) != 0;
   }
   void KillAsync(instrumented_io_context &io_service, bool force) override {
-    bool expected = false;
-    killing_.compare_exchange_strong(expected, true, std::memory_order_acq_rel);
+    // Relaxed ordering is sufficient: the flag doesn't publish any other data,
+    // it only records that a kill was requested.
+    flags_.fetch_or(kKillingFlag, std::memory_order_relaxed);
+  }
+  bool IsKilled() const {
+    return (flags_.load(std::memory_order_relaxed) & kKillingFlag) != 0;
+  }
+  void MarkBlocked() override {
+    flags_.fetch_or(kBlockedFlag, std::memory_order_relaxed);
+  }
+  void MarkUnblocked() override {
+    flags_.fetch_and(static_cast<uint8_t>(~kBlockedFlag), std::memory_order_relaxed);
+  }
+  bool IsBlocked() const override {
+    return (flags_.load(std::memory_order_relaxed) & kBlockedFlag) != 0;
   }
-  bool IsKilled() const { return killing_.load(std::memory_order_acquire); }
-  void MarkBlocked() override { blocked_ = true; }
-  void MarkUnblocked() override { blocked_ = false; }
-  bool IsBlocked() const override { return blocked_; }
 
   Process GetProcess() const override { return proc_; }
   StartupToken GetStartupToken() const override { return 0; }
@@ -145,10 +174,16 @@ class MockWorker : public WorkerInterface {
     RAY_CHECK(false) << "Method unused";
   }
 
-  void ClearAllocatedInstances() override { allocated_instances_ = nullptr; }
+  void ClearAllocatedInstances() override {
+    std::atomic_store_explicit(&allocated_instances_,
+                               std::shared_ptr<TaskResourceInstances>(),
+                               std::memory_order_release);
+  }
 
   void ClearLifetimeAllocatedInstances() override {
-    lifetime_allocated_instances_ = nullptr;
+    std::atomic_store_explicit(&lifetime_allocated_instances_,
+                               std::shared_ptr<TaskResourceInstances>(),
+                               std::memory_order_release);
   }
 
   const BundleID &GetBundleId() const override {
@@ -187,24 +222,32 @@ class MockWorker : public WorkerInterface {
   };
 
  private:
-  WorkerID worker_id_;
-  int port_;
+  // Bits of flags_. The two optional<bool>s are packed as presence/value bit
+  // pairs; blocked/killing are plain flags.
+  static constexpr uint8_t kIsGpuPresentFlag = 1 << 0;
+  static constexpr uint8_t kIsGpuValueFlag = 1 << 1;
+  static constexpr uint8_t kIsActorWorkerPresentFlag = 1 << 2;
+  static constexpr uint8_t kIsActorWorkerValueFlag = 1 << 3;
+  static constexpr uint8_t kBlockedFlag = 1 << 4;
+  static constexpr uint8_t kKillingFlag = 1 << 5;
+
+  // Members are ordered largest to smallest to minimize padding; scheduling
+  // tests iterate thousands of these.
+  RayTask task_;
   rpc::Address address_;
   std::shared_ptr<TaskResourceInstances> allocated_instances_;
   std::shared_ptr<TaskResourceInstances> lifetime_allocated_instances_;
   std::vector<double> borrowed_cpu_instances_;
-  std::optional<bool> is_gpu_;
-  std::optional<bool> is_actor_worker_;
+  Process proc_;
   BundleID bundle_id_;
-  bool blocked_ = false;
-  RayTask task_;
   absl::Time task_assign_time_;
-  int runtime_env_hash_;
+  WorkerID worker_id_;
   TaskID task_id_;
   JobID job_id_;
   ActorID root_detached_actor_id_;
-  Process proc_;
-  std::atomic<bool> killing_ = false;
+  int port_;
+  int runtime_env_hash_;
+  std::atomic<uint8_t> flags_{0};
 };
 
 }  // namespace raylet
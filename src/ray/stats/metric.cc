@@ -14,8 +14,16 @@
 
 #include "ray/stats/metric.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
 #include "opencensus/stats/measure_registry.h"
 
 namespace ray {
@@ -24,10 +32,251 @@ namespace stats {
 
 namespace internal {
 
+namespace {
+
+/// Accumulates counter, sum and histogram submissions per thread and flushes
+/// them to the OpenTelemetry recorder at the stats report interval. Batching
+/// is exact for these metric types: the recorder adds counter/sum values as
+/// deltas, and histogram samples are replayed individually at flush time.
+/// Gauges are not batched because only the latest value matters and callers
+/// (including tests) expect it to be observable immediately.
+///
+/// Each recording thread owns a shard so that the hot path only touches an
+/// uncontended per-thread mutex; the flusher thread swaps out the accumulated
+/// batches and dispatches them outside any lock.
+class MetricBatcher {
+ public:
+  /// Key identifying one time series: metric name plus the fully-resolved
+  /// OpenTelemetry tag map.
+  using BatchKey = std::pair<std::string, absl::flat_hash_map<std::string, std::string>>;
+
+  struct Accumulator {
+    StatsType type = StatsType::COUNT;
+    double sum = 0;
+    // Only used for histograms. Bounded by kMaxHistogramSamples.
+    std::vector<double> samples;
+  };
+
+  static MetricBatcher &instance() {
+    // Leaked so that metrics recorded from static destructors during process
+    // exit never observe a destroyed batcher.
+    static auto *batcher = new MetricBatcher();
+    return *batcher;
+  }
+
+  void Add(const std::string &name,
+           StatsType type,
+           absl::flat_hash_map<std::string, std::string> &&tags,
+           double value) {
+    Shard &shard = LocalShard();
+    std::vector<double> overflow_samples;
+    BatchKey overflow_key;
+    {
+      absl::MutexLock lock(&shard.mutex);
+      auto it = shard.batches.try_emplace(BatchKey(name, std::move(tags))).first;
+      auto &acc = it->second;
+      acc.type = type;
+      if (type == StatsType::HISTOGRAM) {
+        acc.samples.push_back(value);
+        if (acc.samples.size() >= kMaxHistogramSamples) {
+          // Drain inline to bound per-thread memory; this is rare at the
+          // default report interval.
+          overflow_key = it->first;
+          overflow_samples = std::move(acc.samples);
+          shard.batches.erase(it);
+        }
+      } else {
+        acc.sum += value;
+      }
+    }
+    if (!overflow_samples.empty()) {
+      DispatchHistogram(overflow_key, overflow_samples);
+    }
+  }
+
+  /// Drain every shard and forward the accumulated values to the recorder.
+  void Flush() {
+    std::vector<absl::flat_hash_map<BatchKey, Accumulator>> drained;
+    {
+      absl::MutexLock registry_lock(&registry_mutex_);
+      for (Shard *shard : shards_) {
+        absl::MutexLock lock(&shard->mutex);
+        if (!shard->batches.empty()) {
+          drained.emplace_back(std::move(shard->batches));
+          shard->batches.clear();
+        }
+      }
+    }
+    for (auto &batches : drained) {
+      Dispatch(batches);
+    }
+  }
+
+ private:
+  struct Shard {
+    absl::Mutex mutex;
+    absl::flat_hash_map<BatchKey, Accumulator> batches;
+  };
+
+  /// Registers the calling thread's shard on first use and drains it when the
+  /// thread exits.
+  struct ShardHandle {
+    explicit ShardHandle(MetricBatcher *batcher)
+        : batcher(batcher), shard(new Shard()) {
+      absl::MutexLock lock(&batcher->registry_mutex_);
+      batcher->shards_.push_back(shard);
+    }
+
+    ~ShardHandle() {
+      absl::flat_hash_map<BatchKey, Accumulator> remaining;
+      {
+        absl::MutexLock lock(&batcher->registry_mutex_);
+        auto &shards = batcher->shards_;
+        shards.erase(std::find(shards.begin(), shards.end(), shard));
+        remaining = std::move(shard->batches);
+      }
+      delete shard;
+      batcher->Dispatch(remaining);
+    }
+
+    MetricBatcher *batcher;
+    Shard *shard;
+  };
+
+  MetricBatcher() {
+    std::thread([this] {
+      while (true) {
+        auto interval = StatsConfig::instance().GetReportInterval();
+        if (interval <= absl::ZeroDuration()) {
+          interval = absl::Seconds(10);
+        }
+        absl::SleepFor(interval);
+        Flush();
+      }
+    }).detach();
+  }
+
+  Shard &LocalShard() {
+    thread_local ShardHandle handle(this);
+    return *handle.shard;
+  }
+
+  void Dispatch(const absl::flat_hash_map<BatchKey, Accumulator> &batches) {
+    auto &recorder = OpenTelemetryMetricRecorder::GetInstance();
+    for (const auto &[key, acc] : batches) {
+      if (acc.type == StatsType::HISTOGRAM) {
+        DispatchHistogram(key, acc.samples);
+      } else {
+        recorder.SetMetricValue(
+            key.first,
+            absl::flat_hash_map<std::string, std::string>(key.second),
+            acc.sum);
+      }
+    }
+  }
+
+  void DispatchHistogram(const BatchKey &key, const std::vector<double> &samples) {
+    auto &recorder = OpenTelemetryMetricRecorder::GetInstance();
+    for (double sample : samples) {
+      recorder.SetMetricValue(
+          key.first, absl::flat_hash_map<std::string, std::string>(key.second), sample);
+    }
+  }
+
+  static constexpr size_t kMaxHistogramSamples = 1024;
+
+  absl::Mutex registry_mutex_;
+  std::vector<Shard *> shards_;
+};
+
+/// Processes view removals queued by ~Metric on a background thread, so that
+/// tearing down many Metric objects doesn't serialize on the exporter's
+/// global mutex.
+class MetricReaper {
+ public:
+  static MetricReaper &instance() {
+    // Leaked for the same reason as MetricBatcher: Metric destructors may run
+    // during static destruction at process exit.
+    static auto *reaper = new MetricReaper();
+    return *reaper;
+  }
+
+  void EnqueueRemoveView(std::string name) {
+    absl::MutexLock lock(&mutex_);
+    pending_removals_.push_back(std::move(name));
+  }
+
+  /// Drop queued removals of `name` and wait out any removal of it that is
+  /// already executing. Must be called before (re)registering a view named
+  /// `name`: a stale removal queued by a destroyed same-named Metric would
+  /// otherwise delete the new metric's view, which is never re-registered
+  /// because registration is once-per-object.
+  void CancelPendingRemovals(const std::string &name) {
+    absl::MutexLock lock(&mutex_);
+    pending_removals_.erase(
+        std::remove(pending_removals_.begin(), pending_removals_.end(), name),
+        pending_removals_.end());
+    const auto name_not_in_flight = [this, &name] {
+      return in_flight_.find(name) == in_flight_.end();
+    };
+    mutex_.Await(absl::Condition(&name_not_in_flight));
+  }
+
+  /// Synchronously remove all queued views. Names are marked in-flight while
+  /// their RemoveView call runs outside the lock so CancelPendingRemovals can
+  /// wait for them.
+  void Drain() {
+    mutex_.Lock();
+    while (!pending_removals_.empty()) {
+      std::string name = std::move(pending_removals_.back());
+      pending_removals_.pop_back();
+      ++in_flight_[name];
+      mutex_.Unlock();
+      // RemoveView takes the exporter's global mutex; don't hold ours across
+      // the call.
+      opencensus::stats::StatsExporter::RemoveView(name);
+      mutex_.Lock();
+      const auto it = in_flight_.find(name);
+      if (--it->second == 0) {
+        in_flight_.erase(it);
+      }
+    }
+    mutex_.Unlock();
+  }
+
+ private:
+  MetricReaper() {
+    std::thread([this] {
+      while (true) {
+        {
+          absl::MutexLock lock(&mutex_);
+          mutex_.Await(absl::Condition(
+              +[](std::vector<std::string> *queue) { return !queue->empty(); },
+              &pending_removals_));
+        }
+        Drain();
+      }
+    }).detach();
+  }
+
+  absl::Mutex mutex_;
+  std::vector<std::string> pending_removals_;
+  /// Removals currently executing outside the lock, counted per name since
+  /// Drain may run concurrently on the reaper thread and in Shutdown.
+  absl::flat_hash_map<std::string, int> in_flight_;
+};
+
+}  // namespace
+
+void FlushMetricBatches() { MetricBatcher::instance().Flush(); }
+
+void DrainMetricViewRemovals() { MetricReaper::instance().Drain(); }
+
 void RegisterAsView(opencensus::stats::ViewDescriptor view_descriptor,
                     const std::vector<opencensus::tags::TagKey> &keys) {
   // Register global keys.
-  for (const auto &tag : ray::stats::StatsConfig::instance().GetGlobalTags()) {
+  const auto global_tags = ray::stats::StatsConfig::instance().GetGlobalTagsSnapshot();
+  for (const auto &tag : *global_tags) {
     view_descriptor = view_descriptor.add_column(tag.first);
   }
 
@@ -35,10 +284,26 @@ void RegisterAsView(opencensus::stats::ViewDescriptor view_descriptor,
   for (const auto &key : keys) {
     view_descriptor = view_descriptor.add_column(key);
   }
-  opencensus::stats::View view(view_descriptor);
+  // A destroyed Metric with this name may have queued its view for removal;
+  // cancel that first so the stale removal cannot delete the view registered
+  // below after a destroy-then-recreate of the same metric.
+  MetricReaper::instance().CancelPendingRemovals(view_descriptor.name());
+  // RegisterForExport is a descriptor-level API; no View object is needed.
   view_descriptor.RegisterForExport();
 }
 
+void RegisterAsView(const std::string &name,
+                    const std::string &description,
+                    const opencensus::stats::Aggregation &aggregation,
+                    const std::vector<opencensus::tags::TagKey> &keys) {
+  RegisterAsView(opencensus::stats::ViewDescriptor()
+                     .set_name(name)
+                     .set_description(description)
+                     .set_measure(name)
+                     .set_aggregation(aggregation),
+                 keys);
+}
+
 }  // namespace internal
 ///
 /// Stats Config
@@ -50,38 +315,125 @@ StatsConfig &StatsConfig::instance() {
 }
 
 void StatsConfig::SetGlobalTags(const TagsType &global_tags) {
-  global_tags_ = global_tags;
+  std::atomic_store_explicit(&global_tags_,
+                             std::make_shared<const TagsType>(global_tags),
+                             std::memory_order_release);
+}
+
+std::shared_ptr<const TagsType> StatsConfig::GetGlobalTagsSnapshot() const {
+  return std::atomic_load_explicit(&global_tags_, std::memory_order_acquire);
+}
+
+void StatsConfig::SetEnabledMetrics(absl::flat_hash_set<std::string> names) {
+  // An empty set clears the allowlist rather than disabling everything, so an
+  // unset config string keeps the default record-everything behavior.
+  std::shared_ptr<const absl::flat_hash_set<std::string>> allowlist;
+  if (!names.empty()) {
+    allowlist =
+        std::make_shared<const absl::flat_hash_set<std::string>>(std::move(names));
+  }
+  std::atomic_store_explicit(
+      &enabled_metrics_, std::move(allowlist), std::memory_order_release);
 }
 
-const TagsType &StatsConfig::GetGlobalTags() const { return global_tags_; }
+bool StatsConfig::IsMetricEnabled(std::string_view name) const {
+  auto enabled_metrics =
+      std::atomic_load_explicit(&enabled_metrics_, std::memory_order_acquire);
+  return enabled_metrics == nullptr || enabled_metrics->contains(name);
+}
 
 void StatsConfig::SetIsDisableStats(bool disable_stats) {
-  is_stats_disabled_ = disable_stats;
+  is_stats_disabled_.store(disable_stats, std::memory_order_relaxed);
 }
 
-bool StatsConfig::IsStatsDisabled() const { return is_stats_disabled_; }
-
 void StatsConfig::SetReportInterval(const absl::Duration interval) {
-  report_interval_ = interval;
+  report_interval_ns_.store(absl::ToInt64Nanoseconds(interval),
+                            std::memory_order_relaxed);
 }
 
-const absl::Duration &StatsConfig::GetReportInterval() const { return report_interval_; }
+absl::Duration StatsConfig::GetReportInterval() const {
+  return absl::Nanoseconds(report_interval_ns_.load(std::memory_order_relaxed));
+}
 
 void StatsConfig::SetHarvestInterval(const absl::Duration interval) {
-  harvest_interval_ = interval;
+  harvest_interval_ns_.store(absl::ToInt64Nanoseconds(interval),
+                             std::memory_order_relaxed);
 }
 
-const absl::Duration &StatsConfig::GetHarvestInterval() const {
-  return harvest_interval_;
+absl::Duration StatsConfig::GetHarvestInterval() const {
+  return absl::Nanoseconds(harvest_interval_ns_.load(std::memory_order_relaxed));
 }
 
-void StatsConfig::SetIsInitialized(bool initialized) { is_initialized_ = initialized; }
+void StatsConfig::SetIsInitialized(bool initialized) {
+  is_initialized_.store(initialized, std::memory_order_release);
+}
 
-bool StatsConfig::IsInitialized() const { return is_initialized_; }
+bool StatsConfig::IsInitialized() const {
+  return is_initialized_.load(std::memory_order_acquire);
+}
 
 ///
 /// Metric
 ///
+namespace {
+
+/// Valid non-leading metric name characters: [a-zA-Z0-9_:].
+constexpr bool IsMetricNameBodyChar(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+         c == '_' || c == ':';
+}
+
+/// Branchless check that 8 consecutive bytes are all valid non-leading metric
+/// name characters.
+bool AllMetricNameBodyChars8(const char *p) {
+  uint64_t w;
+  std::memcpy(&w, p, sizeof(w));
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kMsb = 0x8080808080808080ULL;
+  if ((w & kMsb) != 0) {
+    // Non-ASCII byte present.
+    return false;
+  }
+  // For ASCII bytes, (b + (0x80 - n)) sets bit 7 iff b >= n. The per-byte sums
+  // never exceed 0xFF, so no carries leak across byte lanes.
+  const auto ge = [w](uint64_t n) { return (w + (0x80 - n) * kOnes) & kMsb; };
+  const auto le = [w](uint64_t n) { return ~(w + (0x7F - n) * kOnes) & kMsb; };
+  // ':' is '9' + 1, so digits and ':' form one contiguous range.
+  const uint64_t digit_or_colon = ge('0') & le(':');
+  const uint64_t upper = ge('A') & le('Z');
+  const uint64_t lower = ge('a') & le('z');
+  // Underscore is a degenerate range check. The classic zero-byte trick on
+  // w ^ '_' ((x - kOnes) & ~x & kMsb) is not usable here: subtracting kOnes
+  // borrows across byte lanes when a lane is zero (a real underscore) and
+  // falsely flags a neighboring '^' (0x5E) byte as an underscore.
+  const uint64_t underscore = ge('_') & le('_');
+  return (digit_or_colon | upper | lower | underscore) == kMsb;
+}
+
+}  // namespace
+
+bool Metric::IsValidMetricName(std::string_view name) {
+  if (name.empty()) {
+    return false;
+  }
+  const auto first = static_cast<unsigned char>(name[0]);
+  if (!IsMetricNameBodyChar(first) || (first >= '0' && first <= '9')) {
+    return false;
+  }
+  size_t i = 1;
+  for (; i + 8 <= name.size(); i += 8) {
+    if (!AllMetricNameBodyChars8(name.data() + i)) {
+      return false;
+    }
+  }
+  for (; i < name.size(); ++i) {
+    if (!IsMetricNameBodyChar(static_cast<unsigned char>(name[i]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 using MeasureDouble = opencensus::stats::Measure<double>;
 Metric::Metric(const std::string &name,
                std::string description,
@@ -90,10 +442,9 @@ Metric::Metric(const std::string &name,
     : name_(name),
       description_(std::move(description)),
       unit_(std::move(unit)),
-      measure_(nullptr),
-      name_regex_(GetMetricNameRegex()) {
+      measure_(nullptr) {
   RAY_CHECK_WITH_DISPLAY(
-      std::regex_match(name, Metric::name_regex_),
+      IsValidMetricName(name),
       "Invalid metric name: " + name +
           ". Metric names can only contain letters, numbers, _, and :. "
           "Metric names cannot start with numbers. Metric name cannot be "
@@ -101,18 +452,27 @@ Metric::Metric(const std::string &name,
   for (const auto &key : tag_keys) {
     tag_keys_.push_back(opencensus::tags::TagKey::Register(key));
   }
+  tag_key_names_.reserve(tag_keys_.size());
+  tag_key_lookup_.reserve(tag_keys_.size());
+  for (const auto &tag_key : tag_keys_) {
+    tag_key_names_.insert(tag_key.name());
+    tag_key_lookup_.emplace(tag_key.name(), tag_key);
+  }
 }
 
-const std::regex &Metric::GetMetricNameRegex() {
-  const static std::regex name_regex("^[a-zA-Z_:][a-zA-Z0-9_:]*$");
-  return name_regex;
+bool Metric::IsEnabledCached() {
+  int8_t enabled = enabled_.load(std::memory_order_relaxed);
+  if (enabled < 0) {
+    enabled = StatsConfig::instance().IsMetricEnabled(name_) ? 1 : 0;
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+  return enabled != 0;
 }
 
-void Metric::Record(double value, TagsType tags) {
-  if (StatsConfig::instance().IsStatsDisabled()) {
+void Metric::RecordSlow(double value, TagsType tags) {
+  if (!IsEnabledCached()) {
     return;
   }
-
   if (::RayConfig::instance().experimental_enable_open_telemetry_on_core()) {
     // Register the metric if it hasn't been registered yet; otherwise, this is a no-op.
     // We defer metric registration until the first time it's recorded, rather than during
@@ -127,32 +487,53 @@ void Metric::Record(double value, TagsType tags) {
     // improvements.
     //
     // This function is thread-safe.
-    RegisterOpenTelemetryMetric();
+    std::call_once(otel_registered_once_, [this] {
+      otel_recorder_ = &OpenTelemetryMetricRecorder::GetInstance();
+      RegisterOpenTelemetryMetric();
+    });
+    auto global_tags = StatsConfig::instance().GetGlobalTagsSnapshot();
     // Collect tags from both the metric-specific tags and the global tags.
     absl::flat_hash_map<std::string, std::string> open_telemetry_tags;
-    std::unordered_set<std::string> tag_keys_set;
-    for (const auto &tag_key : tag_keys_) {
-      tag_keys_set.insert(tag_key.name());
-    }
-    // Insert metric-specific tags that match the expected keys.
-    for (const auto &tag : tags) {
-      const std::string &key = tag.first.name();
-      if (tag_keys_set.count(key)) {
-        open_telemetry_tags[key] = tag.second;
+    open_telemetry_tags.reserve(tag_keys_.size() + global_tags->size());
+    // Insert metric-specific tags that match the expected keys. Tag-less
+    // metrics (bare counters are common) skip the matching loop entirely;
+    // any provided tags could not match anyway.
+    if (!tag_keys_.empty()) {
+      for (const auto &tag : tags) {
+        const std::string &key = tag.first.name();
+        if (tag_key_names_.contains(key)) {
+          open_telemetry_tags[key] = tag.second;
+        }
       }
     }
     // Add global tags, overwriting any existing tag keys.
-    for (const auto &tag : StatsConfig::instance().GetGlobalTags()) {
+    for (const auto &tag : *global_tags) {
       open_telemetry_tags[tag.first.name()] = tag.second;
     }
-    OpenTelemetryMetricRecorder::GetInstance().SetMetricValue(
-        name_, std::move(open_telemetry_tags), value);
+    const StatsType type = GetType();
+    if (type != StatsType::GAUGE) {
+      // Counter, sum and histogram submissions are accumulated per thread and
+      // flushed at the report interval, amortizing the recorder dispatch (and
+      // its mutex) across many Record calls. Gauges are set synchronously
+      // since only the latest value is meaningful.
+      internal::MetricBatcher::instance().Add(
+          name_, type, std::move(open_telemetry_tags), value);
+      return;
+    }
+    otel_recorder_->SetMetricValue(name_, std::move(open_telemetry_tags), value);
 
     return;
   }
 
-  absl::MutexLock lock(&registration_mutex_);
-  if (measure_ == nullptr) {
+  std::call_once(measure_once_, [this] {
+    // The lookup/register pair must be serialized across Metric objects, not
+    // just per object: two same-named metrics recording their first value on
+    // different threads could both see the lookup miss, and the loser of the
+    // MeasureDouble::Register race would receive an invalid measure and drop
+    // every subsequent Record. The mutex is only ever taken here, so the
+    // steady state stays lock-free.
+    static absl::Mutex registration_mutex;
+    absl::MutexLock lock(&registration_mutex);
     // Measure could be registered before, so we try to get it first.
     MeasureDouble registered_measure =
         opencensus::stats::MeasureRegistry::GetMeasureDoubleByName(name_);
@@ -164,38 +545,49 @@ void Metric::Record(double value, TagsType tags) {
           MeasureDouble::Register(name_, description_, unit_));
     }
     RegisterView();
-  }
+  });
 
   // Do record.
+  auto global_tags = StatsConfig::instance().GetGlobalTagsSnapshot();
   TagsType combined_tags(std::move(tags));
-  combined_tags.insert(std::end(combined_tags),
-                       std::begin(StatsConfig::instance().GetGlobalTags()),
-                       std::end(StatsConfig::instance().GetGlobalTags()));
+  combined_tags.reserve(combined_tags.size() + global_tags->size());
+  combined_tags.insert(
+      std::end(combined_tags), std::begin(*global_tags), std::end(*global_tags));
   opencensus::stats::Record({{*measure_, value}}, std::move(combined_tags));
 }
 
-void Metric::Record(double value,
-                    std::unordered_map<std::string_view, std::string> tags) {
+template <typename MapT>
+void Metric::RecordImpl(double value, MapT tags) {
   TagsType tags_pair_vec;
-  tags_pair_vec.reserve(tags.size());
-  std::for_each(tags.begin(), tags.end(), [&tags_pair_vec](auto &tag) {
-    return tags_pair_vec.emplace_back(TagKeyType::Register(tag.first),
-                                      std::move(tag.second));
-  });
+  // Reserve room for the global tags as well so that the downstream append
+  // never reallocates.
+  tags_pair_vec.reserve(tags.size() +
+                        StatsConfig::instance().GetGlobalTagsSnapshot()->size());
+  for (auto &tag : tags) {
+    tags_pair_vec.emplace_back(LookupTagKey(tag.first), std::move(tag.second));
+  }
   Record(value, std::move(tags_pair_vec));
 }
 
-void Metric::Record(double value, std::unordered_map<std::string, std::string> tags) {
-  TagsType tags_pair_vec;
-  tags_pair_vec.reserve(tags.size());
-  std::for_each(tags.begin(), tags.end(), [&tags_pair_vec](auto &tag) {
-    return tags_pair_vec.emplace_back(TagKeyType::Register(tag.first),
-                                      std::move(tag.second));
-  });
-  Record(value, std::move(tags_pair_vec));
+template void Metric::RecordImpl(double value,
+                                 std::unordered_map<std::string_view, std::string> tags);
+template void Metric::RecordImpl(double value,
+                                 std::unordered_map<std::string, std::string> tags);
+
+TagKeyType Metric::LookupTagKey(std::string_view tag_key_name) const {
+  auto it = tag_key_lookup_.find(tag_key_name);
+  if (it != tag_key_lookup_.end()) {
+    return it->second;
+  }
+  // Unexpected key; fall back to the global registry.
+  return TagKeyType::Register(tag_key_name);
 }
 
-Metric::~Metric() { opencensus::stats::StatsExporter::RemoveView(name_); }
+Metric::~Metric() {
+  // RemoveView takes the exporter's global mutex; queue the removal to the
+  // reaper thread so destroying many metrics doesn't serialize on it.
+  internal::MetricReaper::instance().EnqueueRemoveView(std::move(name_));
+}
 
 void Gauge::RegisterOpenTelemetryMetric() {
   // Register the metric in OpenTelemetry.
@@ -203,13 +595,8 @@ void Gauge::RegisterOpenTelemetryMetric() {
 }
 
 void Gauge::RegisterView() {
-  opencensus::stats::ViewDescriptor view_descriptor =
-      opencensus::stats::ViewDescriptor()
-          .set_name(name_)
-          .set_description(description_)
-          .set_measure(name_)
-          .set_aggregation(opencensus::stats::Aggregation::LastValue());
-  internal::RegisterAsView(view_descriptor, tag_keys_);
+  internal::RegisterAsView(
+      name_, description_, opencensus::stats::Aggregation::LastValue(), tag_keys_);
 }
 
 void Histogram::RegisterOpenTelemetryMetric() {
@@ -218,15 +605,12 @@ void Histogram::RegisterOpenTelemetryMetric() {
 }
 
 void Histogram::RegisterView() {
-  opencensus::stats::ViewDescriptor view_descriptor =
-      opencensus::stats::ViewDescriptor()
-          .set_name(name_)
-          .set_description(description_)
-          .set_measure(name_)
-          .set_aggregation(opencensus::stats::Aggregation::Distribution(
-              opencensus::stats::BucketBoundaries::Explicit(boundaries_)));
-
-  internal::RegisterAsView(view_descriptor, tag_keys_);
+  internal::RegisterAsView(
+      name_,
+      description_,
+      opencensus::stats::Aggregation::Distribution(
+          opencensus::stats::BucketBoundaries::Explicit(boundaries_)),
+      tag_keys_);
 }
 
 void Count::RegisterOpenTelemetryMetric() {
@@ -234,14 +618,8 @@ void Count::RegisterOpenTelemetryMetric() {
 }
 
 void Count::RegisterView() {
-  opencensus::stats::ViewDescriptor view_descriptor =
-      opencensus::stats::ViewDescriptor()
-          .set_name(name_)
-          .set_description(description_)
-          .set_measure(name_)
-          .set_aggregation(opencensus::stats::Aggregation::Count());
-
-  internal::RegisterAsView(view_descriptor, tag_keys_);
+  internal::RegisterAsView(
+      name_, description_, opencensus::stats::Aggregation::Count(), tag_keys_);
 }
 
 void Sum::RegisterOpenTelemetryMetric() {
@@ -249,14 +627,8 @@ void Sum::RegisterOpenTelemetryMetric() {
 }
 
 void Sum::RegisterView() {
-  opencensus::stats::ViewDescriptor view_descriptor =
-      opencensus::stats::ViewDescriptor()
-          .set_name(name_)
-          .set_description(description_)
-          .set_measure(name_)
-          .set_aggregation(opencensus::stats::Aggregation::Sum());
-
-  internal::RegisterAsView(view_descriptor, tag_keys_);
+  internal::RegisterAsView(
+      name_, description_, opencensus::stats::Aggregation::Sum(), tag_keys_);
 }
 
 }  // namespace stats
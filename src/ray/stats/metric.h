@@ -16,15 +16,18 @@
 
 #include <ctype.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <regex>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/time/time.h"
 #include "opencensus/stats/stats.h"
 #include "opencensus/stats/stats_exporter.h"
 #include "opencensus/tags/tag_key.h"
@@ -48,18 +51,30 @@ class StatsConfig final {
  public:
   static StatsConfig &instance();
 
-  /// Get the current global tags.
-  const TagsType &GetGlobalTags() const;
-
-  /// Get whether or not stats are enabled.
-  bool IsStatsDisabled() const;
+  /// Get a shared snapshot of the current global tags. The snapshot is only
+  /// replaced by SetGlobalTags(), so hot paths can load it once and iterate it
+  /// without copying the underlying vector. Callers must hold the shared_ptr
+  /// for as long as they read the tags; a plain reference would dangle as soon
+  /// as SetGlobalTags() swaps in a new snapshot.
+  std::shared_ptr<const TagsType> GetGlobalTagsSnapshot() const;
+
+  /// Get whether or not stats are enabled. Defined inline so the per-Record
+  /// fast-path check compiles down to a single relaxed load at the call site.
+  bool IsStatsDisabled() const noexcept {
+    return is_stats_disabled_.load(std::memory_order_relaxed);
+  }
 
-  const absl::Duration &GetReportInterval() const;
+  absl::Duration GetReportInterval() const;
 
-  const absl::Duration &GetHarvestInterval() const;
+  absl::Duration GetHarvestInterval() const;
 
   bool IsInitialized() const;
 
+  /// Whether a metric is enabled for recording. Metrics are enabled by
+  /// default; when an allowlist has been set via SetEnabledMetrics(), only
+  /// listed names are recorded.
+  bool IsMetricEnabled(std::string_view name) const;
+
   ///
   /// Functions that should be used only inside stats::Init()
   /// NOTE: StatsConfig is not thread-safe. If you use these functions
@@ -76,6 +91,11 @@ class StatsConfig final {
   void SetIsDisableStats(bool disable_stats);
   /// Set the global tags that will be appended to all metrics in this process.
   void SetGlobalTags(const TagsType &global_tags);
+  /// Restrict recording to the given metric names; an empty set clears the
+  /// allowlist and re-enables all metrics. Metrics resolve and cache their
+  /// verdict on first Record, so like the other setters this must be called
+  /// before any metric is recorded.
+  void SetEnabledMetrics(absl::flat_hash_set<std::string> names);
   /// Add the initializer
   void AddInitializer(std::function<void()> func) {
     initializers_.push_back(std::move(func));
@@ -91,21 +111,32 @@ class StatsConfig final {
  private:
   StatsConfig() = default;
 
-  TagsType global_tags_;
-  /// If true, don't collect metrics in this process.
-  bool is_stats_disabled_ = true;
-  // Regular reporting interval for all reporters.
-  absl::Duration report_interval_ = absl::Milliseconds(10000);
-  // Time interval for periodic aggregation.
+  /// Global tags, held behind a shared snapshot so that readers on the record
+  /// hot path never copy the vector. Updated only by SetGlobalTags().
+  std::shared_ptr<const TagsType> global_tags_ = std::make_shared<const TagsType>();
+  /// If true, don't collect metrics in this process. Atomic because it is
+  /// checked on every Record call, potentially racing with Init/Shutdown.
+  std::atomic<bool> is_stats_disabled_{true};
+  // Regular reporting interval for all reporters, in nanoseconds. Stored as an
+  // atomic integer so readers never race with Init.
+  std::atomic<int64_t> report_interval_ns_{
+      absl::ToInt64Nanoseconds(absl::Milliseconds(10000))};
+  // Time interval for periodic aggregation, in nanoseconds.
   // Exporter may capture empty collection if harvest interval is longer than
   // report interval. So harvest interval is suggusted to be half of report
   // interval.
-  absl::Duration harvest_interval_ = absl::Milliseconds(5000);
+  std::atomic<int64_t> harvest_interval_ns_{
+      absl::ToInt64Nanoseconds(absl::Milliseconds(5000))};
   // Whether or not if the stats has been initialized.
-  bool is_initialized_ = false;
+  std::atomic<bool> is_initialized_{false};
+  /// Optional allowlist of metric names; null means all metrics are enabled.
+  /// Held behind a shared snapshot like the global tags.
+  std::shared_ptr<const absl::flat_hash_set<std::string>> enabled_metrics_;
   std::vector<std::function<void()>> initializers_;
 };
 
+enum StatsType : int { COUNT, SUM, GAUGE, HISTOGRAM };
+
 /// A thin wrapper that wraps the `opencensus::tag::measure` for using it simply.
 class Metric {
  public:
@@ -118,31 +149,84 @@ class Metric {
 
   Metric &operator()() { return *this; }
 
-  static const std::regex &GetMetricNameRegex();
+  /// Check that a metric name matches `[a-zA-Z_:][a-zA-Z0-9_:]*`. This is the
+  /// same grammar previously enforced with std::regex, hand-rolled because
+  /// metric construction shouldn't pay for an NFA execution.
+  static bool IsValidMetricName(std::string_view name);
 
   /// Get the name of this metric.
   const std::string &GetName() const { return name_; }
 
+  /// Get the aggregation type of this metric.
+  virtual StatsType GetType() const = 0;
+
   /// Record the value for this metric.
   void Record(double value) { Record(value, TagsType{}); }
 
   /// Record the value for this metric.
   ///
+  /// The disabled check is inlined so callers pay a single relaxed load when
+  /// stats are off; the actual recording lives out of line in RecordSlow.
+  ///
   /// \param value The value that we record.
   /// \param tags The tag values that we want to record for this metric record.
-  void Record(double value, TagsType tags);
+  void Record(double value, TagsType tags) {
+    if (StatsConfig::instance().IsStatsDisabled()) {
+      return;
+    }
+    if (enabled_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    RecordSlow(value, std::move(tags));
+  }
 
   /// Record the value for this metric.
   ///
   /// \param value The value that we record.
   /// \param tags The map tag values that we want to record for this metric record.
-  void Record(double value, std::unordered_map<std::string_view, std::string> tags);
-  void Record(double value, std::unordered_map<std::string, std::string> tags);
+  void Record(double value, std::unordered_map<std::string_view, std::string> tags) {
+    if (StatsConfig::instance().IsStatsDisabled()) {
+      return;
+    }
+    if (enabled_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    RecordImpl(value, std::move(tags));
+  }
+  void Record(double value, std::unordered_map<std::string, std::string> tags) {
+    if (StatsConfig::instance().IsStatsDisabled()) {
+      return;
+    }
+    if (enabled_.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    RecordImpl(value, std::move(tags));
+  }
 
  protected:
   virtual void RegisterView() = 0;
   virtual void RegisterOpenTelemetryMetric() = 0;
 
+  /// Resolve a tag key name to its TagKey handle, using the precomputed
+  /// per-metric lookup and falling back to the global registry for keys this
+  /// metric doesn't declare.
+  TagKeyType LookupTagKey(std::string_view tag_key_name) const;
+
+ private:
+  /// Out-of-line recording path, entered only when stats are enabled.
+  void RecordSlow(double value, TagsType tags);
+
+  /// Resolve (and cache) whether this metric passes the allowlist. The cached
+  /// verdict makes disabled metrics a single relaxed load in the inline
+  /// Record stubs.
+  bool IsEnabledCached();
+
+  /// Shared conversion for the map-taking Record overloads: builds the tag
+  /// vector with exact capacity in one pass and forwards to the vector
+  /// overload. Explicitly instantiated in metric.cc for both map types.
+  template <typename MapT>
+  void RecordImpl(double value, MapT tags);
+
  protected:
   std::string name_;
   std::string description_;
@@ -151,10 +235,36 @@ class Metric {
   std::unique_ptr<opencensus::stats::Measure<double>> measure_;
 
  private:
-  const std::regex &name_regex_;
-
-  // For making sure thread-safe to all of metric registrations.
-  inline static absl::Mutex registration_mutex_;
+  /// Names of the expected tag keys, precomputed at construction so that Record
+  /// doesn't rebuild a hash set per call. The views point into the tag key
+  /// registry, which is never deallocated.
+  absl::flat_hash_set<std::string_view> tag_key_names_;
+
+  /// Maps tag key names to their registered TagKey handles so that the map
+  /// Record overloads avoid the global registry lock in TagKeyType::Register
+  /// for the expected keys.
+  absl::flat_hash_map<std::string, TagKeyType> tag_key_lookup_;
+
+  /// Guards the lazy measure registration on the OpenCensus path. Previously a
+  /// mutex shared by all Metric objects was taken on every Record call just to
+  /// test measure_ for null; the once_flag makes the steady state a single
+  /// acquire load with no cross-metric contention. The registration itself
+  /// still takes a shared mutex (inside the call_once lambda) so same-named
+  /// Metric objects cannot race MeasureDouble::Register.
+  std::once_flag measure_once_;
+
+  /// Guards the lazy OpenTelemetry registration; once registered, the
+  /// per-Record check is a single acquire load.
+  std::once_flag otel_registered_once_;
+
+  /// Cached pointer to the OpenTelemetry recorder singleton, set under
+  /// otel_registered_once_ so Record skips the singleton guard check. The
+  /// recorder is leaked intentionally and outlives all Metric objects.
+  OpenTelemetryMetricRecorder *otel_recorder_ = nullptr;
+
+  /// Allowlist verdict: -1 unresolved, 0 filtered out, 1 enabled. Resolved on
+  /// first Record against StatsConfig::IsMetricEnabled().
+  std::atomic<int8_t> enabled_{-1};
 };  // class Metric
 
 class Gauge : public Metric {
@@ -165,6 +275,8 @@ class Gauge : public Metric {
         const std::vector<std::string> &tag_keys = {})
       : Metric(name, description, unit, tag_keys) {}
 
+  StatsType GetType() const override { return StatsType::GAUGE; }
+
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
@@ -180,6 +292,8 @@ class Histogram : public Metric {
             const std::vector<std::string> &tag_keys = {})
       : Metric(name, description, unit, tag_keys), boundaries_(boundaries) {}
 
+  StatsType GetType() const override { return StatsType::HISTOGRAM; }
+
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
@@ -197,6 +311,8 @@ class Count : public Metric {
         const std::vector<std::string> &tag_keys = {})
       : Metric(name, description, unit, tag_keys) {}
 
+  StatsType GetType() const override { return StatsType::COUNT; }
+
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
@@ -211,17 +327,34 @@ class Sum : public Metric {
       const std::vector<std::string> &tag_keys = {})
       : Metric(name, description, unit, tag_keys) {}
 
+  StatsType GetType() const override { return StatsType::SUM; }
+
  private:
   void RegisterView() override;
   void RegisterOpenTelemetryMetric() override;
 
 };  // class Sum
 
-enum StatsType : int { COUNT, SUM, GAUGE, HISTOGRAM };
-
 namespace internal {
 void RegisterAsView(opencensus::stats::ViewDescriptor view_descriptor,
                     const std::vector<opencensus::tags::TagKey> &keys);
+
+/// Build and register a view named after its measure with the given
+/// aggregation; shared by the Metric subclasses' RegisterView overrides.
+void RegisterAsView(const std::string &name,
+                    const std::string &description,
+                    const opencensus::stats::Aggregation &aggregation,
+                    const std::vector<opencensus::tags::TagKey> &keys);
+
+/// Flush all per-thread metric batches to the OpenTelemetry recorder. Called
+/// periodically by the background flusher thread and from stats::Shutdown() to
+/// drain pending submissions.
+void FlushMetricBatches();
+
+/// Synchronously process all queued view removals from destroyed Metric
+/// objects. Called from stats::Shutdown() so no removal outlives the exporter.
+void DrainMetricViewRemovals();
+
 template <StatsType T>
 struct StatsTypeMap {
   static constexpr const char *val = "_void";
@@ -340,6 +473,12 @@ class Stats {
                            const std::vector<opencensus::tags::TagKey>,
                            const std::vector<double> &buckets)> register_func)
       : name_(measure), tag_keys_(convert_tags(tag_keys)) {
+    // The tag keys are fixed by the DEFINE_stats site, so resolve names to
+    // TagKey handles once here instead of registering per Record call.
+    tag_key_lookup_.reserve(tag_keys_.size());
+    for (const auto &tag_key : tag_keys_) {
+      tag_key_lookup_.emplace(tag_key.name(), tag_key);
+    }
     auto stats_init = [register_func, measure, description, buckets, this]() {
       measure_ = std::make_unique<Measure>(Measure::Register(measure, description, ""));
       register_func(measure, description, tag_keys_, buckets);
@@ -363,6 +502,7 @@ class Stats {
     }
 
     absl::flat_hash_map<std::string, std::string> open_telemetry_tags;
+    open_telemetry_tags.reserve(open_census_tags.size());
     for (auto &[tag_key, tag_val] : open_census_tags) {
       open_telemetry_tags[tag_key.name()] = tag_val;
     }
@@ -385,7 +525,7 @@ class Stats {
     if (StatsConfig::instance().IsStatsDisabled() || !measure_) {
       return;
     }
-    TagsType combined_tags = StatsConfig::instance().GetGlobalTags();
+    TagsType combined_tags = *StatsConfig::instance().GetGlobalTagsSnapshot();
     CheckPrintableChar(tag_val);
     combined_tags.emplace_back(tag_keys_[0], std::move(tag_val));
     RecordValue(val, combined_tags);
@@ -398,10 +538,14 @@ class Stats {
     if (StatsConfig::instance().IsStatsDisabled() || !measure_) {
       return;
     }
-    TagsType combined_tags = StatsConfig::instance().GetGlobalTags();
+    TagsType combined_tags = *StatsConfig::instance().GetGlobalTagsSnapshot();
+    combined_tags.reserve(combined_tags.size() + tags.size());
     for (auto &[tag_key, tag_val] : tags) {
       CheckPrintableChar(tag_val);
-      combined_tags.emplace_back(TagKeyType::Register(tag_key), std::move(tag_val));
+      auto it = tag_key_lookup_.find(tag_key);
+      combined_tags.emplace_back(
+          it != tag_key_lookup_.end() ? it->second : TagKeyType::Register(tag_key),
+          std::move(tag_val));
     }
     RecordValue(val, combined_tags);
   }
@@ -414,7 +558,7 @@ class Stats {
     if (StatsConfig::instance().IsStatsDisabled() || !measure_) {
       return;
     }
-    TagsType combined_tags = StatsConfig::instance().GetGlobalTags();
+    TagsType combined_tags = *StatsConfig::instance().GetGlobalTagsSnapshot();
     for (auto const &[tag_key, tag_val] : tags) {
       CheckPrintableChar(tag_val);
     }
@@ -435,6 +579,9 @@ class Stats {
 
   const std::string name_;
   const std::vector<opencensus::tags::TagKey> tag_keys_;
+  /// Name-to-handle table for the declared tag keys, so Record never takes
+  /// the global tag key registry lock for expected keys.
+  absl::flat_hash_map<std::string, TagKeyType> tag_key_lookup_;
   std::unique_ptr<opencensus::stats::Measure<double>> measure_;
 };
 
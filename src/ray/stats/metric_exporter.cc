@@ -58,7 +58,8 @@ void OpenCensusProtoExporter::addGlobalTagsToGrpcMetric(
     opencensus::proto::metrics::v1::Metric &metric) {
   if (std::string_view(metric.metric_descriptor().name())
           .substr(0, kGrpcIoMetricsNamePrefix.size()) == kGrpcIoMetricsNamePrefix) {
-    for (const auto &[key, value] : ray::stats::StatsConfig::instance().GetGlobalTags()) {
+    const auto global_tags = ray::stats::StatsConfig::instance().GetGlobalTagsSnapshot();
+    for (const auto &[key, value] : *global_tags) {
       metric.mutable_metric_descriptor()->add_label_keys()->set_key(key.name());
       for (auto &timeseries : *metric.mutable_timeseries()) {
         timeseries.add_label_values()->set_value(value);
@@ -123,9 +123,14 @@ static inline void Shutdown() {
     return;
   }
   if (RayConfig::instance().experimental_enable_open_telemetry_on_core()) {
+    // Drain any per-thread metric batches before flushing the recorder.
+    internal::FlushMetricBatches();
     OpenTelemetryMetricRecorder::GetInstance().Shutdown();
   } else {
     metrics_io_service_pool->Stop();
+    // Apply any view removals queued by destroyed metrics before the exporter
+    // goes away.
+    internal::DrainMetricViewRemovals();
     opencensus::stats::DeltaProducer::Get()->Shutdown();
     opencensus::stats::StatsExporter::Shutdown();
     metrics_io_service_pool = nullptr;
@@ -16,12 +16,15 @@
 
 #include <chrono>
 #include <iostream>
+#include <regex>
+#include <string>
 #include <thread>
 #include <vector>
 
 #include "absl/memory/memory.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "opencensus/stats/measure_registry.h"
 #include "ray/stats/metric_defs.h"
 
 DEFINE_stats(test_hist,
@@ -113,7 +116,8 @@ TEST_F(StatsTest, InitializationTest) {
                      WorkerID::Nil());
   }
 
-  auto &first_tag = ray::stats::StatsConfig::instance().GetGlobalTags()[0];
+  const auto first_tag =
+      ray::stats::StatsConfig::instance().GetGlobalTagsSnapshot()->front();
   ASSERT_TRUE(first_tag.second != test_tag_value_that_shouldnt_be_applied);
 
   ray::stats::Shutdown();
@@ -125,7 +129,8 @@ TEST_F(StatsTest, InitializationTest) {
 
   ray::stats::Init(global_tags, MetricsAgentPort, WorkerID::Nil());
   ASSERT_TRUE(ray::stats::StatsConfig::instance().IsInitialized());
-  auto &new_first_tag = ray::stats::StatsConfig::instance().GetGlobalTags()[0];
+  const auto new_first_tag =
+      ray::stats::StatsConfig::instance().GetGlobalTagsSnapshot()->front();
   ASSERT_TRUE(new_first_tag.second == test_tag_value_that_shouldnt_be_applied);
 }
 
@@ -215,6 +220,47 @@ TEST_F(StatsTest, TestShutdownTakesLongTime) {
   ray::stats::Shutdown();
 }
 
+TEST(MetricNameValidationTest, MatchesLegacyRegexGrammar) {
+  // Reference implementation: the std::regex that Metric::IsValidMetricName's
+  // SWAR scanner replaced.
+  const std::regex legacy_grammar("^[a-zA-Z_:][a-zA-Z0-9_:]*$");
+  auto legacy_valid = [&legacy_grammar](const std::string &name) {
+    return std::regex_match(name, legacy_grammar);
+  };
+
+  // Every single-character name.
+  for (int c = 0; c < 256; ++c) {
+    const std::string name(1, static_cast<char>(c));
+    ASSERT_EQ(stats::Metric::IsValidMetricName(name), legacy_valid(name))
+        << "byte " << c << " as full name";
+  }
+
+  // Every byte in every lane of the 8-byte chunk that follows the leading
+  // character.
+  for (size_t lane = 0; lane < 8; ++lane) {
+    for (int c = 0; c < 256; ++c) {
+      std::string name = "maaaaaaaa";
+      name[1 + lane] = static_cast<char>(c);
+      ASSERT_EQ(stats::Metric::IsValidMetricName(name), legacy_valid(name))
+          << "byte " << c << " at lane " << lane;
+    }
+  }
+
+  // Every adjacent byte pair within the chunk, to catch carries or borrows
+  // leaking across byte lanes (a "_^" pair used to be falsely accepted).
+  for (size_t lane = 0; lane + 1 < 8; ++lane) {
+    for (int c1 = 0; c1 < 256; ++c1) {
+      for (int c2 = 0; c2 < 256; ++c2) {
+        std::string name = "maaaaaaaa";
+        name[1 + lane] = static_cast<char>(c1);
+        name[2 + lane] = static_cast<char>(c2);
+        ASSERT_EQ(stats::Metric::IsValidMetricName(name), legacy_valid(name))
+            << "bytes " << c1 << "," << c2 << " at lane " << lane;
+      }
+    }
+  }
+}
+
 TEST_F(StatsTest, STAT_DEF) {
   ray::stats::Shutdown();
   ray::stats::Init({}, MetricsAgentPort, WorkerID::Nil());
@@ -222,6 +268,42 @@ TEST_F(StatsTest, STAT_DEF) {
   STATS_test_declare.Record(1.0, "Test");
 }
 
+TEST_F(StatsTest, MetricAllowlist) {
+  // Reinitialize without the mock exporter; this test records metrics the
+  // mock's assertions don't expect.
+  ray::stats::Shutdown();
+  ray::stats::Init({}, MetricsAgentPort, WorkerID::Nil());
+
+  // A metric's first Record registers its backing measure, which makes
+  // recording vs. dropping observable through the measure registry.
+  auto measure_registered = [](const std::string &name) {
+    return opencensus::stats::MeasureRegistry::GetMeasureDoubleByName(name).IsValid();
+  };
+
+  // Default: no allowlist, every metric is enabled and records.
+  ASSERT_TRUE(stats::StatsConfig::instance().IsMetricEnabled("allowlist_default"));
+  stats::Count default_metric("allowlist_default", "", "");
+  default_metric.Record(1.0);
+  ASSERT_TRUE(measure_registered("allowlist_default"));
+
+  stats::StatsConfig::instance().SetEnabledMetrics({"allowlist_enabled"});
+  ASSERT_TRUE(stats::StatsConfig::instance().IsMetricEnabled("allowlist_enabled"));
+  ASSERT_FALSE(stats::StatsConfig::instance().IsMetricEnabled("allowlist_dropped"));
+
+  // A listed metric records; an unlisted one is dropped before it ever
+  // registers its measure.
+  stats::Count enabled_metric("allowlist_enabled", "", "");
+  stats::Count dropped_metric("allowlist_dropped", "", "");
+  enabled_metric.Record(1.0);
+  dropped_metric.Record(1.0);
+  ASSERT_TRUE(measure_registered("allowlist_enabled"));
+  ASSERT_FALSE(measure_registered("allowlist_dropped"));
+
+  // An empty set clears the allowlist so later tests see the default.
+  stats::StatsConfig::instance().SetEnabledMetrics({});
+  ASSERT_TRUE(stats::StatsConfig::instance().IsMetricEnabled("allowlist_dropped"));
+}
+
 }  // namespace ray
 
 int main(int argc, char **argv) {